@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArrayBundle.o : ESMCI_ArrayBundle.h
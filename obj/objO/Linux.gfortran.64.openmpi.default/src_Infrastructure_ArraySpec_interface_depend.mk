@@ -0,0 +1,75 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ArraySpec.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ArraySpec.o : ESMCI_ArraySpec.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_ArraySpec.o : ESMCI_ArraySpec.h ESMC_ArraySpec.h
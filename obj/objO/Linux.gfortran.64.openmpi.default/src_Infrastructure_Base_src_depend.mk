@@ -0,0 +1,100 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Base.o : ESMCI_Base.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Info.o : ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDef.o : ESMCI_Base.h ESMCI_Info.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCDefGeneric.o : ESMCI_Base.h ESMCI_Info.h
@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DistGrid.o : ESMCI_DistGrid.h
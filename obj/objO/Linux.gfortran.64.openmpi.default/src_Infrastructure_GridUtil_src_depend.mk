@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GridToMesh.o : ESMCI_GridToMesh.h ESMCI_Ptypes.h
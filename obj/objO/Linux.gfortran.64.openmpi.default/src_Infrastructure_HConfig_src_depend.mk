@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HConfig.o : ESMCI_HConfig.h
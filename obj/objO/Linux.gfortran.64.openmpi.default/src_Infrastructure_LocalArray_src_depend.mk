@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LocalArray.o : ESMCI_LocalArray.h
@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_LogErr.o : ESMCI_ErrMsgs.C ESMCI_LogErr.h
@@ -0,0 +1,1350 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_SolverUtil_C.o :  
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Attr.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BBox.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CommRel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Context.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_DDir.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Exception.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FieldReg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GeomRendezvous.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GlobalIds.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_HAdapt.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_IOField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Kernel.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MasterElement.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MCoord.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEFamily.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEImprint.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDB.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshExodus.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshGen.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshllField.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshMerge.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObj.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjConn.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjPack.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshObjTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPartition.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshPNC.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRead.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRefine.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshSkin.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshUtils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshVTK.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MEValues.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Migrator.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParEnv.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ParLog.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Phedra.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Polynomial.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Quadrature.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rebalance.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RefineTopo.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SFuncAdaptor.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ShapeLagrange.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SmallAlloc.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SparseMsg.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeights.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WriteWeightsPar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FindPnts.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_SM.o : 
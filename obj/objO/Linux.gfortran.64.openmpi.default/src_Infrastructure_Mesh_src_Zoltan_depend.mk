@@ -0,0 +1,4000 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/all_allo.o : all_allo_const.h params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/assign_param_vals.o : params_const.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/bind_param.o : params_const.h zoltan_mem.h zoltan_util.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/box_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_graph.o : all_allo_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/build_machine_desc.o : ha_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_dist_graph.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_err_const.h dr_util_const.h lbi_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/check_param.o : params_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_init_dist.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_assign.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_geom.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_graph.o : ch_input_const.h dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ch_input_read.o : ch_input_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/coloring.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/color_test.o : all_allo_const.h coloring.h g2l_hash.h params_const.h parmetis_jostle.h zoltan_mem.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_create.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_destroy.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_do_reverse.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_exchange_sizes.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_info.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_map.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_invert_plan.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_resize.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/comm_sort_ints.o : comm.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/costs.o : costs.h octree_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/create_proc_list.o : create_proc_list_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Create.o : DD.h zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Destroy.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Find.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Hash2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Print.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Remove.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Hash_Fn.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn1.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn2.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Set_Neighbor_Hash_Fn3.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Stats.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/DD_Update.o : DD.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dfs.o : costs_const.h dfs.h migoct_const.h migtags_const.h msg_const.h oct_util_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/divide_machine.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_chaco_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_dd.o : dr_const.h dr_dd.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem.o : dr_const.h dr_elem_const.h dr_err_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_elem_util.o : dr_const.h dr_elem_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_err.o : dr_err_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_eval.o : dr_const.h dr_eval_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_exoII_io.o : dr_const.h dr_elem_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_gnuplot.o : dr_const.h dr_err_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_input.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_input_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_loadbal.o : ch_init_dist_const.h dr_const.h dr_err_const.h dr_eval_const.h dr_loadbal_const.h dr_util_const.h zoltan_id.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_maps.o : dr_const.h dr_err_const.h dr_maps_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_migrate.o : dr_const.h dr_dd.h dr_elem_util_const.h dr_err_const.h dr_loadbal_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mmio.o : dr_mmio.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_mm_readfile.o : dr_hg_readfile.h dr_input_const.h dr_mmio.h dr_util_const.h zoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_output.o : dr_const.h dr_err_const.h dr_input_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_par_util.o : dr_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_random_io.o : ch_init_dist_const.h ch_input_const.h dr_const.h dr_elem_util_const.h dr_err_const.h dr_input_const.h dr_maps_const.h dr_output_const.h dr_par_util_const.h dr_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/dr_util.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmesh.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exmisc.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exphg.o : exzoltan.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/free_params.o : params_const.h zoltan_mem.h zoltan_types.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/g2l_hash.o : coloring.h g2l_hash.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/get_processor_name.o : ha_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_box_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc.o : hsfc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_hilbert.o : hsfc.h hsfc_hilbert_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/hsfc_point_assign.o : hsfc.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial1d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial2d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/inertial3d.o : rib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/key_params.o : key_params.h params_const.h timer_const.h zz_const.h zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_balance.o : all_allo_const.h ha_const.h key_params.h zz_const.h zz_rand.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_box_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_copy.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_eval.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_free.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_init.o : lb_init_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_invert.o : all_allo_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_migrate.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_part2proc.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_point_assign.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_remap.o : phg_hypergraph.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_method.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/lb_set_part_sizes.o : zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migoct.o : all_allo_const.h migoct_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migreg.o : dfs_const.h migreg.h oct_util_const.h octree_const.h zoltan_comm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/migtags.o : all_allo_const.h migoct_const.h migtags_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpistring.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/msg.o : msg_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octant.o : oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_plot.o : octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octree.o : all_allo_const.h octree_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/octupdate.o : costs_const.h dfs_const.h migoct_const.h migreg_const.h migtags_const.h oct_util_const.h octree_const.h octupdate.h octupdate_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/oct_util.o : SFC.h dfs_const.h oct_util_const.h octant_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order.o : ha_const.h key_params.h order_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/order_struct.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/output.o : octant_const.h octupdate_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_average.o : par_median_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_bisect.o : par_average_const.h par_bisect_const.h par_tflops_special_const.h shared.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_median.o : par_average_const.h par_median_const.h par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parmetis_jostle.o : all_allo_const.h order_const.h params_const.h parmetis_jostle.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_stats.o : par_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_sync.o : par_const.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/par_tflops_special.o : par_tflops_special_const.h zoltan_mem.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/perm.o : order_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build.o : parmetis_jostle.h phg.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_build_calls.o : parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg.o : all_allo_const.h params_const.h phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_coarse.o : phg.h zoltan_comm.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_comm.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_distrib.o : phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_gather.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_hypergraph.o : phg_hypergraph.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_match.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_order.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_parkway.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_patoh.o : phg.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_plot.o : phg.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_rdivide.o : phg.h phg_distrib.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_refinement.o : phg.h zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_scale.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_serialpartition.o : phg.h zz_heap.h zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_util.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/phg_Vcycle.o : phg.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/point_assign.o : rcb.h rib.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/print_params.o : params_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_box.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb.o : ha_const.h par_bisect_const.h par_median_const.h params_const.h rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rcb_util.o : rcb.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_build.o : params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_coarse_path.o : hsfc_hilbert_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_hash.o : reftree.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/reftree_part.o : all_allo_const.h params_const.h reftree.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib.o : ha_const.h par_median_const.h params_const.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rib_util.o : rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/rootlist.o : all_allo_const.h octree_const.h rootlist_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scatter_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/set_param.o : all_allo_const.h coloring_const.h ha_const.h hsfc_const.h key_params.h octupdate_const.h order_const.h params_const.h parmetis_jostle_const.h phg_const.h rcb_const.h reftree_const.h rib_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/shared.o : all_allo_const.h create_proc_list_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer.o : timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/timer_params.o : params_const.h timer.h zoltan_timer.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/verify_graph.o : parmetis_jostle.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_align.o : zoltan_align.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_id.o : zoltan_id.h zoltan_mem.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zoltan_timer.o : zoltan_mem.h zoltan_timer.h zoltan_types.h zoltan_util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_coord.o : hsfc.h params_const.h rcb.h rib.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_gen_files.o : params_const.h parmetis_jostle.h phg_hypergraph.h zz_const.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_hash.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_heap.o : zz_heap.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_init.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_obj_list.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_rand.o : zz_rand.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_set_fn.o : zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_sort.o : zz_sort.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_struct.o : ha_const.h lb_init_const.h params_const.h zz_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/zz_util.o : zoltan_mem.h zz_util_const.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mem.o : zoltan_mem.h
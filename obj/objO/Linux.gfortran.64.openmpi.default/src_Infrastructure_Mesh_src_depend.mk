@@ -0,0 +1,1024 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_OTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_MathUtil.h ESMCI_OTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ClumpPnts.o : ESMCI_ClumpPnts.h ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MathUtil.o : ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_FileIO_Util.o : ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_ESMFMesh_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_UGRID_Util.o : ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_FileIO.o : ESMCI_ESMFMesh_Util.h ESMCI_FileIO_Util.h ESMCI_Mesh.h ESMCI_MeshDual.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h ESMCI_UGRID_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_GToM_Util.o : ESMCI_GToM_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_GToM_Glue.o : ESMCI_Mesh_GToM_Glue.h ESMCI_MathUtil.h ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_Regrid_Glue.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Regrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh_XGrid_Glue.o : ESMCI_Mesh.h ESMCI_Mesh_XGrid_Glue.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Mesh.o : ESMCI_Mesh.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCap.o : ESMCI_Mesh.h ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_MeshCap.h ESMCI_Mesh_FileIO.h ESMCI_Mesh_GToM_Glue.h ESMCI_Mesh_Glue.h ESMCI_Mesh_Regrid_Glue.h ESMCI_Mesh_XGrid_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshCXX.o : ESMCI_MathUtil.h ESMCI_MeshCXX.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshDual.o : ESMCI_MathUtil.h ESMCI_Mesh.h ESMCI_MeshRedist.h ESMCI_Mesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MeshRedist.o : ESMCI_Mesh.h ESMCI_MeshRedist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_KDTree.o : ESMCI_KDTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_OTree.o : ESMCI_OTree.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Regrid_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_RegridConstants.h ESMCI_Rendez_Nearest.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Rendez_Nearest.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_Nearest.o : ESMCI_KDTree.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Search_NearestNPnts.o : ESMCI_KDTree.h ESMCI_MathUtil.h ESMCI_RegridConstants.h ESMCI_Search_Nearest.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_XGridUtil.o : ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_BBox.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Bilinear.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Conserve.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Rendez_Elem.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Dual.o : ESMCI_MBMesh.h ESMCI_MBMesh_Dual.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Types.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Extrapolation.o : ESMCI_MBMesh.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MBMesh_Util.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_GToM_Glue.o : ESMCI_GToM_Util.h ESMCI_MBMesh.h ESMCI_MBMesh_GToM_Glue.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Mapping.o : ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_ShapeFunc.h ESMCI_MathUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Patch.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Rendez_EtoP.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Redist.o : ESMCI_MBMesh.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Regrid_Glue.o : ESMCI_MBMesh.h ESMCI_MBMesh_Bilinear.h ESMCI_MBMesh_Conserve.h ESMCI_MBMesh_Extrapolation.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Patch.h ESMCI_MBMesh_Regrid_Glue.h ESMCI_MathUtil.h ESMCI_RegridConstants.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_Elem.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Rendez_EtoP.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Redist.h ESMCI_MBMesh_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoE.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search_EtoE.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Search_EtoP.o : ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Glue.h ESMCI_MBMesh_Mapping.h ESMCI_MBMesh_Search_EtoP.h ESMCI_MBMesh_Util.h ESMCI_MathUtil.h ESMCI_XGridUtil.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_ShapeFunc.o : ESMCI_MBMesh_ShapeFunc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_MBMesh_Util.o : ESMCI_MBMesh.h ESMCI_MBMesh_BBox.h ESMCI_MBMesh_Search.h ESMCI_MathUtil.h
@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_PointList.o : ESMCI_PointList.h
@@ -0,0 +1,75 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_RHandle.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle_F.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_RHandle.o : ESMCI_RHandle.h ESMC_RHandle.h
@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_RHandle.o : ESMCI_RHandle.h
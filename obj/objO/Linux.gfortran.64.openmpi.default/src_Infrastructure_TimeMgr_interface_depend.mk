@@ -0,0 +1,475 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Alarm.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AlarmType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Base.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_ClockType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Time.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeInterval.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeIntervalType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TimeType.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_TimeMgr.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_BaseTime_F.o : ESMCI_BaseTime.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Calendar_F.o : ESMCI_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_TimeInterval_F.o : ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Time_F.o : ESMCI_Time.h ESMCI_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Alarm_F.o : ESMCI_Alarm.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Clock_F.o : ESMCI_Clock.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Calendar.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Calendar.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Time.o : ESMCI_Calendar.h ESMCI_Time.h ESMC_Time.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_TimeInterval.o : ESMCI_Calendar.h ESMCI_TimeInterval.h ESMC_TimeInterval.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Clock.o : ESMCI_Clock.h ESMC_Clock.h
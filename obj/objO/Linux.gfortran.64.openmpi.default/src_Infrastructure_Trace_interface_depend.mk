@@ -0,0 +1,50 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Trace.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Trace_F.o : ESMCI_Trace.h
@@ -0,0 +1,225 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Fraction.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Util_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Util.o : ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface_F.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h ESMC_Interface.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction_F.o : ESMCI_F90Interface.h ESMCI_Fraction.h
@@ -0,0 +1,375 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o :  ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilString.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc ESMF_InitMacros.inc ESMF_LogConstants.inc ESMF_LogMacros.inc ESMF_Macros.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StaggerLocType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilCubedSphere.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_AttPackType.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_FortranWordsize.o : ESMF_FortranWordsize.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90 ESMF_TypeKindRankMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_TypeKindGet.o : ESMF_TypeKindGet.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF.h ESMF_TypeKindMacros.hcppF90
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilSort.o : ESMF_UtilSort.cppF90 /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o ESMF_ErrReturnCodes.inc
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Util.o : ESMCI_Macros.h ESMCI_Util.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Fraction.o : ESMCI_Fraction.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_F90Interface.o : ESMCI_F90Interface.h ESMCI_Macros.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_CoordSys.o : ESMCI_CoordSys.h ESMCI_Macros.h ESMC_Util.h
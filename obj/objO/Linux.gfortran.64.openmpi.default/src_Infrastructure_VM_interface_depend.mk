@@ -0,0 +1,75 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_F90Interface.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_IOUtil.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_InitMacros.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM_F.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_VM.o : ESMCI_VM.h ESMC_VM.h
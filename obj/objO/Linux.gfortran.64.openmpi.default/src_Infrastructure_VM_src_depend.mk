@@ -0,0 +1,50 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VM.o : ESMCI_VM.h ESMCI_VMKernel.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_VMKernel.o : ESMCI_AccInfo.h ESMCI_VM.h ESMCI_VMKernel.h
@@ -0,0 +1,25 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/mpi.o : mpi.h
@@ -0,0 +1,100 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Calendar.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Init.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init.o : ESMCI_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_Init.o : ESMC.h ESMCI.h ESMC_Init.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_Init_F.o : 
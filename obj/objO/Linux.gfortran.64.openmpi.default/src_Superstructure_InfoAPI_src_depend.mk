@@ -0,0 +1,50 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoDescribeCDef.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMC_InfoCacheCDef.o : 
@@ -0,0 +1,525 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_StateTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_VM.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServComponent_C.o : /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Clock.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_Comp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_CplComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_GridComp.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_LogErr.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_State.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_UtilTypes.o /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMF_WebServ.o 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServNetEsmfClient.o : ESMCI_WebServNetEsmfClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataDesc.o : ESMCI_WebServDataDesc.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataContent.o : ESMCI_WebServDataContent.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServDataMgr.o : ESMCI_WebServDataMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientInfo.o : ESMCI_WebServClientInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrInfo.o : ESMCI_WebServCompSvrInfo.h ESMCI_WebServNetEsmf.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServClientSocket.o : ESMCI_WebServClientSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServServerSocket.o : ESMCI_WebServServerSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServRegistrarClient.o : ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServComponentSvr.o : ESMCI_WebServComponentSvr.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrClient.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServSocketUtils.o : ESMCI_WebServNetEsmf.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServLowLevelSocket.o : ESMCI_WebServLowLevelSocket.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServCompSvrMgr.o : ESMCI_WebServCompSvrMgr.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServGRAMClient.o : ESMCI_WebServGRAMClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServForkClient.o : ESMCI_WebServForkClient.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrl.o : ESMCI_WebServCompSvrClient.h ESMCI_WebServForkClient.h ESMCI_WebServGRAMClient.h ESMCI_WebServProcCtrl.h ESMCI_WebServRegistrarClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServProcCtrlClient.o : ESMCI_WebServProcCtrlClient.h ESMCI_WebServSocketUtils.h
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ESMCI_WebServ_F.o : ESMCI_WebServ.h ESMCI_WebServComponentSvr.h ESMCI_WebServNetEsmfClient.h ESMCI_WebServNetEsmfServer.h ESMCI_WebServRegistrarClient.h
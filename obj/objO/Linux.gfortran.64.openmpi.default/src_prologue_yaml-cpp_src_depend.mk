@@ -0,0 +1,725 @@
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/binary.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterutils.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodeevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanscalar.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/convert.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exceptions.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/null.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantag.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/directives.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/depthguard.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/exp.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/ostream_wrapper.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scantoken.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emit.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/memory.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parse.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/simplekey.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitfromevents.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/nodebuilder.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/parser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/singledocparser.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitter.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/regex_yaml.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/stream.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/emitterstate.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/node_data.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/scanner.o : 
+  /root/repo/obj/objO/Linux.gfortran.64.openmpi.default/tag.o : 
@@ -336,6 +336,9 @@ namespace ESMCI {
     ~Array(){destruct(false);}
    private:
     void destruct(bool followCreator=true, bool noGarbage=false);
+    // tree based engine behind gather() and scatter()
+    int gatherScatterTree(bool scatterFlag, void *array, int *counts,
+      int tile, int rootPet, VM *vm, int fanIn);
    public:
     // helper
     int constructContiguousFlag(int redDimCount);
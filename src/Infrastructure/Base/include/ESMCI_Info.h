@@ -95,6 +95,11 @@ private:
   bool dirty = false;
   json storage;  // JSON object store for keys/values managed by this instance
   json type_storage;  // JSON object for Fortran typing
+  // CBOR encoding of storage and type_storage computed by an inquire pass of
+  // serialize(), and reused by the following non-inquire pass
+  std::vector<std::uint8_t> serialize_cache;
+  std::vector<std::uint8_t> serialize_cache_types;
+  bool serialize_cache_valid = false;
 
 protected:
   void init(void) {this->storage = json::object(); this->type_storage = json::object();}
@@ -138,8 +143,10 @@ public:
   std::vector<T> getvec(key_t &key, bool recursive = false) const;
 
   virtual const json& getStorageRef(void) const { return this->storage; }
-  virtual json& getStorageRefWritable(void) { return this->storage; }
-  json& getTypeStorageWritable(void) { return this->type_storage; }
+  virtual json& getStorageRefWritable(void) {
+    this->serialize_cache_valid = false; return this->storage; }
+  json& getTypeStorageWritable(void) {
+    this->serialize_cache_valid = false; return this->type_storage; }
   const json& getTypeStorage(void) const { return this->type_storage; }
 
   json const * getPointer(key_t &key, bool recursive = false) const;
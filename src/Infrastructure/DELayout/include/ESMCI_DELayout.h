@@ -34,6 +34,7 @@
 #include <vector>
 #include <map>
 #include <stack>
+#include <atomic>
 
 #include "ESMCI_Base.h"       // Base is superclass to DELayout
 #include "ESMCI_VM.h"
@@ -278,6 +279,8 @@ class XXE{
       send, recv, sendRRA, recvRRA, sendrecv, sendRRArecv,
       // --- non-blocking send, recv
       sendnb, recvnb, sendnbRRA, recvnbRRA,
+      // --- packed non-blocking send, recv
+      sendnbPack, sendnbPackMember, recvnbPack, recvnbPackMember,
       // --- wait
       waitOnIndex, waitOnAnyIndexSub, waitOnIndexRange, waitOnIndexSub,
       // --- test
@@ -293,11 +296,13 @@ class XXE{
       productSumSuperScalarListDstRRA,
       productSumSuperScalarSrcRRA,
       productSumSuperScalarContigRRA,
+      productSumSuperScalarCsrDstRRA,
       // -- zero
       zeroScalarRRA, zeroSuperScalarRRA, zeroMemset, zeroMemsetRRA,
       // --- mem movement
       memCpy, memCpySrcRRA,
       memGatherSrcRRA,
+      memStridedGatherSrcRRA, memStridedScatterDstRRA,
       // --- unconditional subs
       xxeSub, xxeSubMulti,
       // --- profiling
@@ -373,6 +378,50 @@ class XXE{
         vectorLengthMultiplier = vectorLengthMultiplier_;
       }
     };
+
+    struct PackCandidate{
+      // Non-blocking send or receive post of the opstream, as considered for
+      // packing of messages between the same pair of PETs.
+      int index;                // opstream index of the post
+      unsigned long long size;  // message size in byte (w/o vectorLength)
+      int predicateBitField;
+      bool vectorFlag;
+      int tag;
+      int run;                  // -1: post cannot be packed
+                                // >=0: posts with the same run may be packed
+    };
+
+    struct PersistentInfo{
+      // Persistent request state of a non-blocking send or receive element.
+      // Consecutive elements with the same predicate bit field, and distinct
+      // partner PETs, form a run that is started together by its first
+      // element.
+      int mode;                 // 0: non-persistent, 1: persistent,
+                                // -1: fell back to non-persistent in a run
+      int startCount;           // >0: first element of a run of this length
+                                // 0: started by the first element of the run
+      bool boundFlag;           // true: persistent request bound in commhandle
+      char *buffer;             // buffer the request is bound to
+      unsigned long long int size;  // size the request is bound to
+      int bindCount;            // number of times the request was bound
+    };
+
+    struct SsishmInfo{
+      // Shared memory mailbox of a non-blocking send or receive element that
+      // exchanges its messages with a PET on the same SSI. The mailbox is
+      // located in the shared memory segment of the receiving PET. The sender
+      // deposits each message in the mailbox when it is posted, and the
+      // receiver copies it out when waiting for, or testing, the receive.
+      // The counters are lock-free atomics, shared between the processes.
+      std::atomic<unsigned long long> *postCount; // deposited by sender
+      std::atomic<unsigned long long> *doneCount; // taken by receiver
+      char *data;                   // message data
+      unsigned long long capacity;  // capacity of the mailbox in bytes
+      unsigned long long count;     // messages posted by the local element
+      char *buffer;                 // receive buffer of outstanding message
+      unsigned long long size;      // size of outstanding message
+      bool mpiFlag;                 // outstanding message went through MPI
+    };
     
   public:
     VM *vm;
@@ -416,6 +465,8 @@ class XXE{
     int commhandleMaxCount;         // maximum number of elements in commhandle
     int xxeSubMaxCount;             // maximum number of elements in xxeSubList
     RouteHandle *rh;                // associated RouteHandle
+    VMK::memhandle *ssishmMemhandle;  // shared memory of the SSI mailboxes
+    SsishmInfo *ssishmList;         // SSI mailboxes of the opstream elements
     
   public:
     XXE(VM *vmArg, int maxArg=1000, int dataMaxCountArg=1000,
@@ -437,6 +488,8 @@ class XXE{
       lastFilterBitField = 0x0;
       superVectorOkay = true;
       rh = NULL;
+      ssishmMemhandle = NULL;
+      ssishmList = NULL;
     }
     XXE(std::stringstream &streami,
       std::vector<int> *originToTargetMap=NULL,
@@ -497,6 +550,14 @@ class XXE{
     int execReady();
     int optimize();
     int optimizeElement(int index);
+    int threadPartitionElement(int index, int partCount);
+    int csrConvertElement(int index, int partCount, bool simdFlag);
+    int getPackCandidates(bool sendFlag, int pet,
+      std::vector<PackCandidate> &candidateList);
+    int packSendnb(std::vector<int> const &indexList);
+    int packRecvnb(std::vector<int> const &indexList);
+    int prepostRecvnb();
+    int setupSsishm(int vectorLength=1);
     
     int growStream(int increase);
     int growDataList(int increase);
@@ -555,6 +616,14 @@ class XXE{
     int appendMemGatherSrcRRA(int predicateBitField, void *dstBase,
       TKId dstBaseTK, int rraIndex, int chunkCount, bool vectorFlag=false,
       bool indirectionFlag=false);
+    int appendMemStridedGatherSrcRRA(int predicateBitField, void *dstBase,
+      int rraIndex, unsigned long long int rraOffset,
+      unsigned long long int chunkSize, int dimCount, int const *countList,
+      unsigned long long int const *strideList, int vectorLength=1);
+    int appendMemStridedScatterDstRRA(int predicateBitField, void *srcBase,
+      int rraIndex, unsigned long long int rraOffset,
+      unsigned long long int chunkSize, int dimCount, int const *countList,
+      unsigned long long int const *strideList, int vectorLength=1);
     int appendZeroScalarRRA(int predicateBitField, TKId elementTK,
       int rraOffset, int rraIndex);
     int appendZeroSuperScalarRRA(int predicateBitField, TKId elementTK,
@@ -615,6 +684,12 @@ class XXE{
     //                      - false: ignore vectorLength during exec()
     //  indirectionFlag     - true:  interpret buffer as " *(char **)buffer"
     //                        false: interpret buffer as " (char *)buffer"
+    //  threadPartCount     - number of thread partitions of the term lists,
+    //                        0 or 1 for serial execution
+    //  threadPartStart     - first term index of each thread partition,
+    //                        with threadPartCount+1 entries
+    //  simdFlag            - true:  use SIMD kernel if supported at runtime
+    //                        false: use scalar kernel
       
     typedef struct{
       OpId opId;
@@ -716,6 +791,8 @@ class XXE{
       void *buffer;
       unsigned long long int size;
       int tag;
+      PersistentInfo persistent;
+      SsishmInfo *ssishm;     // NULL: messages go through MPI
     }SendnbInfo;
 
     typedef struct{
@@ -730,6 +807,8 @@ class XXE{
       void *buffer;
       unsigned long long int size;
       int tag;
+      PersistentInfo persistent;
+      SsishmInfo *ssishm;     // NULL: messages go through MPI
     }RecvnbInfo;
 
     typedef struct{
@@ -744,6 +823,8 @@ class XXE{
       unsigned long long int size;
       int rraIndex;
       int tag;
+      PersistentInfo persistent;
+      SsishmInfo *ssishm;     // NULL: messages go through MPI
     }SendnbRRAInfo;
 
     typedef struct{
@@ -758,8 +839,30 @@ class XXE{
       unsigned long long int size;
       int rraIndex;
       int tag;
+      PersistentInfo persistent;
+      SsishmInfo *ssishm;     // NULL: messages go through MPI
     }RecvnbRRAInfo;
 
+    typedef struct{
+      OpId opId;
+      int predicateBitField;
+      VMK::commhandle **commhandle;
+      bool activeFlag;
+      bool cancelledFlag;
+      int pet;
+      bool vectorFlag;
+      bool msgActiveFlag;     // group leader: packed message outstanding
+      bool msgCancelledFlag;  // group leader: packed message cancelled
+      int leaderIndex;        // opstream index of the group leader
+      // members below are only valid for the group leader
+      int memberCount;
+      int *memberIndexList;   // opstream indices of members in message order
+      char **memberBufferList;  // BufferInfo of members in message order
+      unsigned long long int *memberSizeList;
+      void *packBuffer;       // BufferInfo of the packed message
+      int tag;
+    }PacknbInfo;  // for: sendnbPack(Member) and recvnbPack(Member)
+
     typedef struct{
       OpId opId;
       int predicateBitField;
@@ -892,6 +995,8 @@ class XXE{
       bool vectorFlag;
       bool indirectionFlag;
       int *valueOffsetList;
+      int threadPartCount;
+      int *threadPartStart;
     }ProductSumSuperScalarDstRRAInfo;
 
     typedef struct{
@@ -911,6 +1016,8 @@ class XXE{
       bool indirectionFlag;
       int *valueOffsetList;
       int *baseListIndexList;
+      int threadPartCount;
+      int *threadPartStart;
     }ProductSumSuperScalarListDstRRAInfo;
 
     typedef struct{
@@ -944,6 +1051,28 @@ class XXE{
       bool indirectionFlag;
     }ProductSumSuperScalarContigRRAInfo;
 
+    typedef struct{
+      // terms in destination sorted CSR form: terms of row r, all updating
+      // element rowOffsetList[r], are rowStartList[r] ... rowStartList[r+1]-1
+      OpId opId;
+      int predicateBitField;
+      TKId elementTK;
+      TKId factorTK;
+      TKId valueTK;
+      int *rowOffsetList;
+      int *rowStartList;
+      void *factorList;
+      void *valueBase;
+      int *valueOffsetList;
+      int rraIndex;
+      int rowCount;
+      int termCount;
+      bool vectorFlag;
+      bool indirectionFlag;
+      bool simdFlag;
+      int threadPartCount;
+    }ProductSumSuperScalarCsrDstRRAInfo;
+
     typedef struct{
       OpId opId;
       int predicateBitField;
@@ -1008,6 +1137,26 @@ class XXE{
       bool vectorFlag;
       bool indirectionFlag;
     }MemGatherSrcRRAInfo;
+
+    // strided box of an RRA block: countList[0] x countList[1] x ... chunks
+    // of chunkSize contiguous bytes, starting at byte rraOffset of the block
+    // and advancing by strideList[i] bytes along the i-th strided dimension.
+    // The box is fixed in bytes, only valid for the vectorLength it was
+    // stored for.
+    static int const stridedDimMax = 6;
+
+    typedef struct{
+      OpId opId;
+      int predicateBitField;
+      char *buffer;             // packed side, contiguous
+      int rraIndex;
+      int dimCount;             // number of strided dimensions in use
+      unsigned long long int rraOffset;
+      unsigned long long int chunkSize;
+      int countList[stridedDimMax];
+      int vectorLength;         // store time vectorLength
+      unsigned long long int strideList[stridedDimMax];
+    }MemStridedRRAInfo;
     
     // --- sub-opstreams
     
@@ -1108,9 +1257,30 @@ class XXE{
     }MultiSubInfo;
     
   private:
+    void commwaitElement(StreamElement *xxeIndexElement, int *vectorLength);
+    void commtestElement(StreamElement *xxeIndexElement, int *completeFlag,
+      int *vectorLength);
+    void commcancelElement(StreamElement *xxeIndexElement);
+    void unpackRecvnb(PacknbInfo *xxePacknbInfo, int *vectorLength);
+    PersistentInfo *getPostInfo(StreamElement *xxeElement, char **rraList,
+      int *vectorLength, char **buffer, unsigned long long int *size,
+      int *tag);
+    PersistentInfo *getPersistentInfo(StreamElement *xxeElement);
+    void setupPersistent(bool updateFlag=false);
+    void startPersistent(int index, char **rraList, int *vectorLength);
+    SsishmInfo *getSsishmInfo(StreamElement *xxeElement);
+    bool ssishmPost(StreamElement *xxeElement, char **rraList,
+      int *vectorLength);
+    bool ssishmFinish(StreamElement *xxeIndexElement, bool waitFlag);
+    void ssishmWaitCount(std::atomic<unsigned long long> *counter,
+      unsigned long long value);
+    void ssishmRelease();
     template<typename T>
     inline static void exec_memGatherSrcRRA(
       MemGatherSrcRRAInfo *xxeMemGatherSrcRRAInfo, int vectorL, char **rraList);
+    inline static void exec_memStridedRRA(
+      MemStridedRRAInfo *xxeMemStridedRRAInfo, char **rraList,
+      bool scatterFlag);
     template<typename T>
     inline static void exec_memGatherSrcRRASuper(
       MemGatherSrcRRAInfo *xxeMemGatherSrcRRAInfo, int vectorL, char **rraList,
@@ -1167,7 +1337,7 @@ class XXE{
       TKId valueTK, int termCount, int vectorL, int resolved,
       int localDeIndexOff,
       int size_r, int size_s, int size_t, int *size_i, int *size_j,
-      bool superVector);
+      bool superVector, int threadPartCount, int *threadPartStart);
     template<typename T, typename U, typename V>
     static void exec_psssDstRra(T *rraBase, int *rraOffsetList, U *factorList,
       V *valueBase, int *valueOffsetList, int termCount, int vectorL);
@@ -1177,13 +1347,30 @@ class XXE{
       int vectorL, int localDeIndexOff,
       int size_r, int size_s, int size_t, int *size_i, int *size_j);
     template<typename T, typename U, typename V>
+    static void psssCsrDstRra(T *rraBase, TKId elementTK, int *rowOffsetList,
+      int *rowStartList, U *factorList, TKId factorTK, V *valueBase,
+      int *valueOffsetList, TKId valueTK, int rowCount, int vectorL,
+      int resolved, int localDeIndexOff,
+      int size_r, int size_s, int size_t, int *size_i, int *size_j,
+      bool superVector, bool simdFlag, int threadPartCount);
+    template<typename T, typename U, typename V>
+    static void exec_psssCsrDstRra(T *rraBase, int *rowOffsetList,
+      int *rowStartList, U *factorList, V *valueBase, int *valueOffsetList,
+      int rowStart, int rowEnd, int vectorL, bool simdFlag);
+    template<typename T, typename U, typename V>
+    static void exec_psssCsrDstRraSuper(T *rraBase, int *rowOffsetList,
+      int *rowStartList, U *factorList, V *valueBase, int *valueOffsetList,
+      int rowStart, int rowEnd, int vectorL, int localDeIndexOff,
+      int size_r, int size_s, int size_t, int *size_i, int *size_j);
+    template<typename T, typename U, typename V>
     static void pssslDstRra(T **rraBaseList, int *rraIndexList, TKId elementTK,
       int *rraOffsetList, U *factorList, TKId factorTK, V **valueBaseList,
       int *valueOffsetList, int *baseListIndexList,
       TKId valueTK, int termCount, int vectorL, int resolved, 
       int localDeIndexOff,
       int size_r, int size_s, int size_t, int *size_i, int *size_j, 
-      bool superVector, RouteHandle *rh);
+      bool superVector, RouteHandle *rh, int threadPartCount,
+      int *threadPartStart);
     template<typename T, typename U, typename V>
     static void exec_pssslDstRra(T **rraBaseList, int *rraIndexList, 
       int *rraOffsetList, U *factorList, V **valueBaseList,
@@ -71,6 +71,10 @@ namespace ESMCI {
       inline static std::string tagRef(YAML::Node &self);
       inline static std::string tag(YAML::Node self);
 
+      static bool collectiveLoad();
+      static int readFile(const std::string& filename, std::string& content);
+      static void cacheClear();
+
       int load(const std::string& content);
       int loadFile(const std::string& filename, int *docIndex=NULL);
       int saveFile(const std::string& filename, int *docIndex=NULL);
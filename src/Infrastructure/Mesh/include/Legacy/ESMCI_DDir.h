@@ -29,7 +29,7 @@ namespace ESMCI {
 
 // Base class for a hash function.  operator() should
 // return the assigned processor for a gid, given
-// the range of all possible gid's.  Defualt is linear.
+// the range of all possible gid's.  This one is linear.
 // Proc returned is between 0 and nproc-1.
 class DDir_lin_hash {
 public:
@@ -42,14 +42,31 @@ virtual UInt operator()(UInt gid, UInt nproc, UInt min, UInt max) const {
 }
 };
 
+// Multiplicative (Fibonacci) hash.  Scrambles the gid with the golden ratio
+// multiplier and scales the result onto the processors, so sparse or
+// clustered gid ranges still spread evenly.  Ignores the gid range.
+// This is the default.
+class DDir_mult_hash : public DDir_lin_hash {
+public:
+DDir_mult_hash() {}
+virtual ~DDir_mult_hash() {}
+virtual UInt operator()(UInt gid, UInt nproc, UInt min, UInt max) const {
+  unsigned int h = (unsigned int) gid * 2654435769u;
+  return (UInt) (((unsigned long long) h * nproc) >> 32);
+}
+};
+
 
 /**
  * Distributed directory of indices.  Provides query operations
  * so a user can find out what processor and local index a given
  * global index has.  The object does this without having to gather
  * the entire directory ever on a single processor.
+ * Create() and each RemoteGID() query exchange their entries in one
+ * MPI_Alltoallv per direction; the entries a processor manages are kept
+ * in a sorted array.
 */
-template<typename HASH=DDir_lin_hash>
+template<typename HASH=DDir_mult_hash>
 class DDir {
 public:
 // Create the DDIR.
@@ -128,6 +145,16 @@ UInt gmin, gmax; // global min and max of id's
 // List of entries.  The list is sorted.
 std::vector<dentry> my_managed;
 
+// Linear interpolation of a managed entry's index from its gid, and the
+// largest distance of any entry from its interpolated index.
+double interp_slope;
+UInt interp_err;
+
+// Index of the first managed entry with gid not less than the given gid
+// (my_managed.size() if none).  Interpolates the index, then binary
+// searches the window of +-interp_err around it.
+UInt find_managed(UInt gid) const;
+
 };
 
 } // namepsace
@@ -212,6 +212,9 @@ public:
   int interp_method;
 };
 
+// Number of threads set through ESMF_RUNTIME_REGRID_THREADS (1 if unset)
+int get_regrid_num_threads();
+
 } // namespace
 
 #endif /*ESMC_INTERP_H_*/
@@ -27,6 +27,13 @@
 
 namespace ESMCI {
 
+ // Wall clock time (in seconds) spent on this PET in the phases of a
+ // regrid() call, so they can be benchmarked separately
+ struct RegridPhaseTimes {
+   double search;   // rendezvous and search (Interp construction)
+   double weights;  // weight calculation
+ };
+
  int regrid(Mesh *srcmesh, PointList *srcpointlist, Mesh *dstmesh, PointList *dstpointlist,
             Mesh *midmesh, IWeights &wts,
             int *regridMethod, 
@@ -38,7 +45,8 @@ namespace ESMCI {
             int *extrapNumLevels,
             int *extrapNumInputLevels, 
             int *unmappedaction,
-            bool set_dst_status, WMat &dst_status, bool checkFlag);
+            bool set_dst_status, WMat &dst_status, bool checkFlag,
+            RegridPhaseTimes *phase_times=NULL);
 
  void translate_split_src_elems_in_wts(Mesh *srcmesh, int num_entries,
                                       int *iientries);
@@ -223,6 +223,93 @@ struct MigTraits<WMat> {
   
 };
  
+/**
+ * Compressed sparse row storage for a weight matrix.  Rows are appended
+ * in any order and then sorted and merged by finalize(), after which the
+ * matrix is read only.  Rows are kept in WMat::Entry order, so walking the
+ * rows gives the same sequence as walking a WMat.  Each entry field is kept
+ * in its own flat array, which avoids the map node and column vector that
+ * WMat allocates for every row.
+ */
+class WMatCSR {
+
+public:
+
+  typedef WMat::Entry Entry;
+
+  WMatCSR();
+
+  ~WMatCSR();
+
+  /*
+   * Append a row.  Rows may come in any order and the same row may be
+   * appended more than once; finalize() sorts and merges them.
+   */
+  void append(const Entry &row, const std::vector<Entry> &cols);
+
+  /*
+   * Move all rows of wmat into this matrix.  The arrays are sized for all
+   * rows up front, and each row is released from wmat once it is copied,
+   * so the peak footprint is the full matrix plus the full wmat.
+   */
+  void append(WMat &wmat);
+
+  /*
+   * Sort rows and their columns and merge duplicate rows the same way
+   * as WMat::InsertRowMerge().
+   */
+  void finalize();
+
+  bool is_finalized() const { return finalized; }
+
+  void clear();
+
+  UInt num_rows() const { return row_id.size(); }
+
+  UInt num_entries() const { return col_id.size(); }
+
+  Entry row(UInt r) const {
+    return Entry(row_id[r], row_idx[r], 0.0, row_src_id[r]);
+  }
+
+  // Columns of row r are the entries [row_begin(r), row_end(r))
+  UInt row_begin(UInt r) const { return offsets[r]; }
+  UInt row_end(UInt r) const { return offsets[r+1]; }
+
+  Entry col(UInt k) const {
+    return Entry(col_id[k], col_idx[k], value[k], col_src_id[k]);
+  }
+
+  Entry::id_type get_col_id(UInt k) const { return col_id[k]; }
+  Entry::value_type get_value(UInt k) const { return value[k]; }
+
+  // Return lowest row which contains ids greater than or equal to id
+  UInt lower_bound_id_row(UInt id) const;
+
+  void GetRowGIDS(std::vector<UInt> &gids) const;
+
+  std::pair<int, int> count_matrix_entries() const;
+
+private:
+
+  WMatCSR(const WMatCSR &);
+  WMatCSR &operator=(const WMatCSR &);
+
+  // Row keys, and offsets of each row's columns (num_rows()+1 entries)
+  std::vector<Entry::id_type> row_id;
+  std::vector<Entry::idx_type> row_idx;
+  std::vector<Entry::id_type> row_src_id;
+  std::vector<UInt> offsets;
+
+  // Column entries
+  std::vector<Entry::id_type> col_id;
+  std::vector<Entry::idx_type> col_idx;
+  std::vector<Entry::value_type> value;
+  std::vector<Entry::id_type> col_src_id;
+
+  bool finalized;
+};
+
 std::ostream &operator <<(std::ostream &os, const WMat::Entry &ent);
 
 } // namespace
@@ -89,6 +89,8 @@ namespace ESMCI {
     static RouteHandle *create(RouteHandle *rh, InterArray<int> *originPetList,
       InterArray<int> *targetPetList, int *rc);
     static RouteHandle *create(const std::string &file, int *rc);
+    static RouteHandle *cacheLoad(const std::string &key,
+      std::vector<int> &info, int *rc);
     static int destroy(RouteHandle *routehandle, bool noGarbage=false);
     int construct(void);
     int destruct(void);
@@ -169,6 +171,9 @@ namespace ESMCI {
     // write RH to file
     int write(const std::string &file) const;
 
+    // store RH in the on-disk RouteHandle cache
+    int cacheStore(const std::string &key, const std::vector<int> &info) const;
+
     // optimize for the communication pattern stored inside the RouteHandle
     int optimize() const;
     bool isCompatible(Array *srcArrayArg, Array *dstArrayArg, int *rc=NULL)
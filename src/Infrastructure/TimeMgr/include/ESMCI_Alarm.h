@@ -147,6 +147,9 @@ class Alarm {
                                   //    checks and to generate unique default
                                   //    names.
                                   //    TODO: inherit from ESMC_Base class
+    int               clockIndex;    // position in clock's alarmList, and
+    int               scheduleSeq;   //  state in clock's alarm schedule
+    bool              scheduleActive;
     static int        count;      // number of alarms created. Thread-safe
                                   //   because int is atomic.
                                   //    TODO: inherit from ESMC_Base class
@@ -69,6 +69,8 @@
 #include "ESMCI_Time.h"
 #include "ESMCI_Alarm.h"
 
+#include <vector>
+
 namespace ESMCI{
 
 // !PUBLIC TYPES:
@@ -111,6 +113,23 @@ namespace ESMCI{
                                                 //  necessary
     Alarm           **alarmList;                // associated alarm array
 
+    // alarm schedule, used while the clock steps forward with a positive
+    //  timeStep: alarms which cannot change state before their ringTime
+    //  wait in a min-heap on ringTime, all others are active and checked on
+    //  every advance
+    struct AlarmQueueEntry {
+      Time   ringTime;               // when to move alarm back to active
+      int    seq;                    // stale unless equal to alarm's seq
+      Alarm *alarm;
+      // reversed, so std::push_heap() keeps the earliest ringTime on top
+      bool operator<(const AlarmQueueEntry &entry) const {
+        return ringTime > entry.ringTime;
+      }
+    };
+    bool              alarmScheduleValid;       // schedule matches alarmList
+    std::vector<Alarm*> alarmActive;            // checked on every advance
+    std::vector<AlarmQueueEntry> alarmQueue;    // min-heap on ringTime
+
     bool              stopTimeEnabled;  // true if optional property set
 
     int               id;         // unique identifier. used for equality
@@ -260,6 +279,15 @@ namespace ESMCI{
     // called only by friend class Alarm
     int addAlarm(Alarm *alarm);    // alarmCreate(), alarmSet() (TMG 4.1, 4.2)
     int removeAlarm(Alarm *alarm); // alarmDestroy(), alarmSet()
+    void alarmChanged(Alarm *alarm); // Alarm state changed outside advance()
+
+    // alarm schedule
+    bool alarmScheduleUsable(void) const;
+    void alarmScheduleReset(void);
+    void alarmScheduleBuild(void);
+    bool alarmSchedule(Alarm *alarm);
+    void alarmScheduleDue(void);
+    static bool alarmIndexLess(const Alarm *a, const Alarm *b);
 
     friend class Alarm;
 
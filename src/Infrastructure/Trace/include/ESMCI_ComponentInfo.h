@@ -97,13 +97,18 @@ namespace ESMCI {
     }
 
     string getPhaseName(ESMFPhaseId phaseId) const {
+      return "[" + _name + "] " + getPhaseLabel(phaseId);
+    }
+
+    // phase name without the component name prefix
+    string getPhaseLabel(ESMFPhaseId phaseId) const {
       for (unsigned int i = 0; i < _phaseIds.size(); i++) {
         if (_phaseIds.at(i) == phaseId) {
-          return "[" + _name + "] " + _phaseNames.at(i);
+          return _phaseNames.at(i);
         }
       }
       stringstream ss;
-      ss <<  "[" << _name << "] " << phaseId.getMethodType() << " " << phaseId.getPhase();
+      ss << phaseId.getMethodType() << " " << phaseId.getPhase();
       return ss.str();
     }
 
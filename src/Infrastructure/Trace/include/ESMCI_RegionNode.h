@@ -40,7 +40,7 @@ namespace ESMCI {
   RegionNode(RegionNode *parent, uint16_t local_id, bool isUserRegion):
     _parent(parent), _global_id(next_global_id()),
       _local_id(local_id), _isUserRegion(isUserRegion),
-      _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
+      _last_child(NULL), _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
       _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
       int localrc;
@@ -53,7 +53,7 @@ namespace ESMCI {
   RegionNode():
     _parent(NULL), _global_id(next_global_id()),
       _local_id(0), _isUserRegion(false),
-      _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
+      _last_child(NULL), _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
       _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
       int localrc;
@@ -64,7 +64,7 @@ namespace ESMCI {
   RegionNode(bool nextGlobalId):
     _parent(NULL), _global_id(0),
       _local_id(0), _isUserRegion(false),
-      _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
+      _last_child(NULL), _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
       _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
       if (nextGlobalId) {
@@ -78,7 +78,7 @@ namespace ESMCI {
   RegionNode(char *deserializeBuffer, size_t bufferSize):
     _parent(NULL), _global_id(0),
       _local_id(0), _isUserRegion(false),
-      _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
+      _last_child(NULL), _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
       _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
       
@@ -91,7 +91,7 @@ namespace ESMCI {
       _local_id(toClone->getLocalId()),
       _name(toClone->getName()),
       _isUserRegion(toClone->isUserRegion()),
-      _pecount(toClone->getPeCount()),
+      _last_child(NULL), _pecount(toClone->getPeCount()),
       _count(toClone->getCount()), _total(toClone->getTotal()),
       _min(toClone->getMin()), _max(toClone->getMax()),
       _mean(toClone->getMean()), _variance(toClone->_variance),
@@ -158,15 +158,22 @@ namespace ESMCI {
     }
 
     RegionNode *getOrAddChild(uint16_t local_id, bool isUserRegion, bool &wasAdded) {
+      //regions in loops re-enter the same child, so check that one first
+      if (_last_child != NULL && _last_child->getLocalId() == local_id) {
+        wasAdded = false;
+        return _last_child;
+      }
       for (unsigned i = 0; i < _children.size(); i++) {
         if (_children.at(i)->getLocalId() == local_id) {
           wasAdded = false;
-          return _children.at(i);
+          _last_child = _children.at(i);
+          return _last_child;
         }
       }
       //no match found
       RegionNode *newNode = new RegionNode(this, local_id, isUserRegion);
       _children.push_back(newNode);
+      _last_child = newNode;
       wasAdded = true;
       return newNode;
     }
@@ -232,6 +239,10 @@ namespace ESMCI {
       return _total;
     }
 
+    uint64_t getLastEntered() const {
+      return _last_entered;
+    }
+
     size_t getPeCount() const {
       return _pecount;
     }
@@ -662,6 +673,7 @@ namespace ESMCI {
     bool _isUserRegion;
    
     vector<RegionNode *> _children;
+    RegionNode *_last_child;  //most recently entered child
 
     size_t _pecount;
 
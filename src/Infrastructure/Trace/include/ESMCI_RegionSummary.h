@@ -12,7 +12,9 @@
 #define ESMCI_REGIONSUMMARY_H
 
 #include <cstddef>
+#include <cstring>
 #include <vector>
+#include <map>
 #include <math.h>
 #include <algorithm>
 #include <string>
@@ -22,6 +24,11 @@
 
 #define UINT64T_BIG 18446744073709551615ULL
 
+// number of histogram buckets per power of two used to estimate percentiles,
+// bounding the relative error of the estimates by 1/SUMMARY_HIST_SUBBUCKETS
+#define SUMMARY_HIST_SUBBITS 5
+#define SUMMARY_HIST_SUBBUCKETS (1 << SUMMARY_HIST_SUBBITS)
+
 using std::vector;
 using std::sort;
 using std::string;
@@ -154,6 +161,30 @@ namespace ESMCI {
       return _name;
     }
 
+    /*
+     * Estimate the q-th quantile (0 < q <= 1) of the totals
+     * across PETs, e.g. q=0.5 for the median. The estimate is
+     * within a relative error of 1/SUMMARY_HIST_SUBBUCKETS.
+     */
+    uint64_t getTotalPercentile(double q) const {
+      if (_pet_count == 0) return 0;
+      //nearest rank
+      uint64_t rank = (uint64_t) ceil(q * _pet_count);
+      if (rank < 1) rank = 1;
+      uint64_t seen = 0;
+      std::map<uint32_t, uint64_t>::const_iterator it;
+      for (it = _total_hist.begin(); it != _total_hist.end(); ++it) {
+        seen += it->second;
+        if (seen >= rank) {
+          uint64_t val = bucketValue(it->first);
+          if (val < _total_min) val = _total_min;
+          if (val > _total_max) val = _total_max;
+          return val;
+        }
+      }
+      return _total_max;
+    }
+
     /*
      * Add a set of PET region timings to the summary
      */
@@ -178,13 +209,175 @@ namespace ESMCI {
 	_total_max = rn.getTotal();
 	_total_max_pet = pet;
       }
+      _total_hist[bucketIndex(rn.getTotal())]++;
       
       //recursively merge child nodes
       mergeChildren(rn, pet);
     }
 
+    /*
+     * Add the summary of another set of PETs to the summary,
+     * e.g. one received from another PET during a reduction
+     */
+    void merge(const RegionSummary &other) {
+
+      if (other._pet_count == 0) {
+        mergeChildren(other);
+        return;
+      }
+
+      _pe_count += other._pe_count;
+
+      if (_pet_count == 0) {
+        _count_each = other._count_each;
+        _counts_match = other._counts_match;
+      }
+      else if (!other._counts_match || _count_each != other._count_each) {
+        _counts_match = false;
+      }
+      _pet_count += other._pet_count;
+
+      _total_sum += other._total_sum;
+      //on ties prefer the lower PET, as a sequential merge would
+      if (_total_min > other._total_min || (_total_min == other._total_min
+        && other._total_min_pet < _total_min_pet)) {
+        _total_min = other._total_min;
+        _total_min_pet = other._total_min_pet;
+      }
+      if (_total_max < other._total_max || (_total_max == other._total_max
+        && other._total_max_pet < _total_max_pet)) {
+        _total_max = other._total_max;
+        _total_max_pet = other._total_max_pet;
+      }
+      std::map<uint32_t, uint64_t>::const_iterator it;
+      for (it = other._total_hist.begin(); it != other._total_hist.end(); ++it) {
+        _total_hist[it->first] += it->second;
+      }
+
+      //recursively merge child nodes
+      mergeChildren(other);
+    }
+
+    /*
+     * Serialize the summary tree, appending to the buffer
+     */
+    void serialize(vector<char> &buffer) const {
+      size_t nameSize = _name.length();
+      append(buffer, &nameSize, sizeof(nameSize));
+      append(buffer, _name.c_str(), nameSize);
+      append(buffer, &_pet_count, sizeof(_pet_count));
+      append(buffer, &_pe_count, sizeof(_pe_count));
+      append(buffer, &_count_each, sizeof(_count_each));
+      int countsMatch = _counts_match ? 1 : 0;
+      append(buffer, &countsMatch, sizeof(countsMatch));
+      append(buffer, &_total_sum, sizeof(_total_sum));
+      append(buffer, &_total_min, sizeof(_total_min));
+      append(buffer, &_total_min_pet, sizeof(_total_min_pet));
+      append(buffer, &_total_max, sizeof(_total_max));
+      append(buffer, &_total_max_pet, sizeof(_total_max_pet));
+      size_t histSize = _total_hist.size();
+      append(buffer, &histSize, sizeof(histSize));
+      std::map<uint32_t, uint64_t>::const_iterator it;
+      for (it = _total_hist.begin(); it != _total_hist.end(); ++it) {
+        append(buffer, &(it->first), sizeof(it->first));
+        append(buffer, &(it->second), sizeof(it->second));
+      }
+      size_t childCount = _children.size();
+      append(buffer, &childCount, sizeof(childCount));
+      for (unsigned i = 0; i < _children.size(); i++) {
+        _children.at(i)->serialize(buffer);
+      }
+    }
+
+    /*
+     * Deserialize a summary tree into this (empty) node,
+     * starting at offset, and update offset to the end
+     * of the serialized tree
+     */
+    void deserialize(const char *buffer, size_t bufferSize, size_t *offset) {
+      size_t nameSize = 0;
+      extract(buffer, bufferSize, offset, &nameSize, sizeof(nameSize));
+      if (nameSize > bufferSize - *offset) {
+        throw std::runtime_error("Buffer too small to deserialize region summary.");
+      }
+      _name = string(buffer + *offset, nameSize);
+      *offset += nameSize;
+      extract(buffer, bufferSize, offset, &_pet_count, sizeof(_pet_count));
+      extract(buffer, bufferSize, offset, &_pe_count, sizeof(_pe_count));
+      extract(buffer, bufferSize, offset, &_count_each, sizeof(_count_each));
+      int countsMatch = 0;
+      extract(buffer, bufferSize, offset, &countsMatch, sizeof(countsMatch));
+      _counts_match = (countsMatch == 1);
+      extract(buffer, bufferSize, offset, &_total_sum, sizeof(_total_sum));
+      extract(buffer, bufferSize, offset, &_total_min, sizeof(_total_min));
+      extract(buffer, bufferSize, offset, &_total_min_pet, sizeof(_total_min_pet));
+      extract(buffer, bufferSize, offset, &_total_max, sizeof(_total_max));
+      extract(buffer, bufferSize, offset, &_total_max_pet, sizeof(_total_max_pet));
+      size_t histSize = 0;
+      extract(buffer, bufferSize, offset, &histSize, sizeof(histSize));
+      for (size_t i = 0; i < histSize; i++) {
+        uint32_t bucket = 0;
+        uint64_t count = 0;
+        extract(buffer, bufferSize, offset, &bucket, sizeof(bucket));
+        extract(buffer, bufferSize, offset, &count, sizeof(count));
+        _total_hist[bucket] = count;
+      }
+      size_t childCount = 0;
+      extract(buffer, bufferSize, offset, &childCount, sizeof(childCount));
+      for (size_t i = 0; i < childCount; i++) {
+        RegionSummary *child = new RegionSummary(this);
+        _children.push_back(child);
+        child->deserialize(buffer, bufferSize, offset);
+      }
+    }
+
   private:
 
+    /*
+     * Logarithmic histogram buckets: values below SUMMARY_HIST_SUBBUCKETS
+     * map to their own bucket, larger values to one of
+     * SUMMARY_HIST_SUBBUCKETS buckets per power of two
+     */
+    static uint32_t bucketIndex(uint64_t val) {
+      if (val < SUMMARY_HIST_SUBBUCKETS) return (uint32_t) val;
+      int exp = 0;
+      while ((val >> exp) >= 2*SUMMARY_HIST_SUBBUCKETS) exp++;
+      return (uint32_t) ((exp + 1) * SUMMARY_HIST_SUBBUCKETS
+        + ((val >> exp) - SUMMARY_HIST_SUBBUCKETS));
+    }
+
+    /*
+     * Midpoint of the value range of a histogram bucket
+     */
+    static uint64_t bucketValue(uint32_t bucket) {
+      if (bucket < SUMMARY_HIST_SUBBUCKETS) return bucket;
+      int exp = bucket / SUMMARY_HIST_SUBBUCKETS - 1;
+      uint64_t low = ((uint64_t) (SUMMARY_HIST_SUBBUCKETS
+        + bucket % SUMMARY_HIST_SUBBUCKETS)) << exp;
+      return low + (((uint64_t) 1 << exp) >> 1);
+    }
+
+    static void append(vector<char> &buffer, const void *data, size_t size) {
+      const char *cdata = (const char *) data;
+      buffer.insert(buffer.end(), cdata, cdata + size);
+    }
+
+    static void extract(const char *buffer, size_t bufferSize, size_t *offset,
+                        void *data, size_t size) {
+      if (*offset + size > bufferSize) {
+        throw std::runtime_error("Buffer too small to deserialize region summary.");
+      }
+      memcpy(data, buffer + *offset, size);
+      *offset += size;
+    }
+
+    void mergeChildren(const RegionSummary &other) {
+      for (unsigned i = 0; i < other._children.size(); i++) {
+	RegionSummary *child = getOrAddChild(other._children.at(i)->getName());
+	child->merge(*(other._children.at(i)));
+      }
+    }
+
     void mergeChildren(const RegionNode &other, int pet) {
       for (unsigned i = 0; i < other.getChildren().size(); i++) {
 	RegionSummary *child = getOrAddChild(other.getChildren().at(i)->getName());
@@ -213,6 +406,7 @@ namespace ESMCI {
     int      _total_min_pet; //PET with min total
     uint64_t _total_max;     //max of all totals
     int      _total_max_pet; //PET with max total
+    std::map<uint32_t, uint64_t> _total_hist; //histogram of totals
     
   };
 
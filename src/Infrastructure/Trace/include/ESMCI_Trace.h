@@ -57,6 +57,17 @@ namespace ESMCI {
     uint64_t latch_ts;  /* latched timestamp */
   };
 
+  // timings accumulated by the profiler for one component phase
+  struct TracePhaseTiming {
+    std::string compName;
+    std::string phaseName;
+    std::string methodType;  // "Init", "Run" or "Final"
+    bool nested;            // phase encloses other component phases
+    size_t count;           // completed executions of the phase
+    uint64_t total;         // total time spent in the phase (ns)
+    uint64_t lastEntered;   // clock value at the most recent entry (ns)
+  };
+
   void TraceInitializeClock(int *rc);
   uint64_t TraceGetClock(void *data);
   void TraceClockLatch(struct esmftrc_platform_filesys_ctx *ctx);
@@ -66,6 +77,7 @@ namespace ESMCI {
   bool TraceInitialized();
   std::string TraceGetMetadataString();
   int TraceMapVmId(VMId *vmid, int *rc);
+  void TraceGetPhaseTimings(std::vector<TracePhaseTiming> &timings, int *rc);
 
   //////////////// IO Tracing //////////
   void DLL_EXPORT TraceIOOpenStart(const char *path);
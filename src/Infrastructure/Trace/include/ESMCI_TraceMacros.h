@@ -24,11 +24,17 @@
   ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT, rc);
 #define ESMCI_REGION_EXIT(name, localrc)       ESMCI::TraceEventRegionExit(name, &(localrc)); \
   ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT, rc);
+#define ESMCI_REGION_ID_ENTER(id, localrc)     ESMCI::TraceEventRegionIdEnter(id, &(localrc)); \
+  ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT, rc);
+#define ESMCI_REGION_ID_EXIT(id, localrc)      ESMCI::TraceEventRegionIdExit(id, &(localrc)); \
+  ESMC_LogDefault.MsgFoundError(localrc, ESMCI_ERR_PASSTHRU, ESMC_CONTEXT, rc);
 #else
 #define ESMCI_METHOD_ENTER(localrc)
 #define ESMCI_METHOD_EXIT(localrc)
 #define ESMCI_REGION_ENTER(name, localrc)
 #define ESMCI_REGION_EXIT(name, localrc) 
+#define ESMCI_REGION_ID_ENTER(id, localrc)
+#define ESMCI_REGION_ID_EXIT(id, localrc)
 #endif
 
 //#ifdef ESMF_PROFILE_PIO
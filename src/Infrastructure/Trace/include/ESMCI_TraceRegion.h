@@ -16,6 +16,9 @@
 namespace ESMCI { 
   void TraceEventRegionEnter(std::string name, int *rc);
   void TraceEventRegionExit(std::string name, int *rc);
+  int TraceRegionRegister(std::string name, int *rc);
+  void TraceEventRegionIdEnter(int regionId, int *rc);
+  void TraceEventRegionIdExit(int regionId, int *rc);
   void TraceEventCompPhaseEnter(ESMCI::Comp *comp, enum ESMCI::method *method, int *phase, int *rc);
   void TraceEventCompPhaseExit(ESMCI::Comp *comp, enum ESMCI::method *method, int *phase, int *rc);
 }
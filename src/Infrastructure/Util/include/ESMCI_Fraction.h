@@ -147,7 +147,11 @@ class Fraction
 //
   private:
 //
- // < declare private interface methods here >
+    // ensure proper fraction and sign, without reducing to lowest denominator
+    int normalize(void);
+
+    // three-way comparison shared by the comparison operators
+    int compare(const Fraction &, int *order) const;
 //
 //EOP
 //-------------------------------------------------------------------------
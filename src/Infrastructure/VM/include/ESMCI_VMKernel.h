@@ -160,7 +160,8 @@ class VMK{
     commhandle *prev_handle;// previous handle in the queue
     commhandle *next_handle;// next handle in the queue
     int nelements;          // number of elements
-    int type;       // 0: commhandle container, 1: MPI_Requests, 2: ... reserved
+    int type;       // 0: commhandle container, 1: MPI_Requests,
+                    // 2: persistent MPI_Requests, 3: ... reserved
     bool sendFlag;          // true if this is a send request
     commhandle **handles;   // sub handles
     MPI_Request *mpireq;    // request array
@@ -509,6 +510,14 @@ class VMK{
     int recv(void *message, unsigned long long int size, int source,
       commhandle **commh, int tag=-1);
 
+    // persistent p2p communication calls
+    int sendinit(const void *message, unsigned long long int size, int dest,
+      commhandle **commh, int tag=-1);
+    int recvinit(void *message, unsigned long long int size, int source,
+      commhandle **commh, int tag=-1);
+    int commstart(int count, commhandle **commhList);
+    void commfree(commhandle **commh);
+
     int sendrecv(void *sendData, int sendSize, int dst, void *recvData,
       int recvSize, int src, int dstTag=-1, int srcTag=-1);
     int sendrecv(void *sendData, int sendSize, int dst, void *recvData,
@@ -38,6 +38,12 @@ namespace ESMCI{
           static CompInfoStore *get_instance(void );
           /* Add information about component into the store */
           void add_comp_info(const CompInfo<T> &comp_info);
+          /* Update information about component in the store. Unlike
+           * add_comp_info(), info for a PET layout (number of PETs)
+           * already in the store is averaged with the stored info
+           * instead of being added as a new sample
+           */
+          void update_comp_info(const CompInfo<T> &comp_info);
           /* Retrieve information stored in the store */
           std::vector<std::pair<T, T> > get_past_time_intervals(
             const CompInfo<T> &comp_info) const;
@@ -60,6 +66,7 @@ namespace ESMCI{
                               const std::string &comp_phase_name,
                               int comp_id);
               void add_info(const CompInfo<T> &comp_info);
+              void update_info(const CompInfo<T> &comp_info);
               std::vector<std::pair<T, T> > get_past_time_intervals(void ) const;
               std::vector<std::pair<int, int> > get_past_pet_ranges(void ) const;
               std::vector<int> get_past_npets(void ) const;
@@ -77,8 +84,10 @@ namespace ESMCI{
               std::vector<T> past_npets_;
               std::vector<T> past_wtimes_;
               std::vector<T> past_stimes_;
+              std::vector<int> past_nsamples_;
               bool sfunc_is_valid_;
               UVIDPoly<T> sfunc_;
+              void fit_scaling_function(void );
           };
           std::map<std::string, CompBackupInfo> backup_info_;
           int next_comp_id_;
@@ -122,6 +131,27 @@ namespace ESMCI{
       }
     }
 
+    /* Update component info */
+    template<typename T>
+    void CompInfoStore<T>::update_comp_info(const CompInfo<T> &comp_info)
+    {
+      std::string backup_info_key = comp_info.get_comp_name() +
+                                    comp_info.get_comp_phase_name();
+      typename std::map<std::string, CompBackupInfo>::iterator iter =
+        backup_info_.find(backup_info_key);
+      if(iter != backup_info_.end()){
+        iter->second.update_info(comp_info);
+      }
+      else{
+        CompBackupInfo binfo(comp_info.get_comp_name(),
+                              comp_info.get_comp_phase_name(),
+                              next_comp_id_++);
+        binfo.update_info(comp_info);
+        backup_info_.insert(std::pair<std::string, CompBackupInfo>(
+                    backup_info_key, binfo));
+      }
+    }
+
     /* Get the stored time intervals for a component phase */
     template<typename T>
     std::vector<std::pair<T, T> > CompInfoStore<T>::get_past_time_intervals(
@@ -282,7 +312,50 @@ namespace ESMCI{
       past_npets_.push_back(pet_range.second - pet_range.first + 1);
       past_wtimes_.push_back(wtime);
       past_stimes_.push_back(stime);
+      past_nsamples_.push_back(1);
+
+      fit_scaling_function();
+    }
+
+    /* Update the info for the PET layout in comp_info. The wallclock time
+     * is a running mean over all samples seen for the same number of PETs,
+     * so repeated samples for a layout do not make the scaling function
+     * fit ill-conditioned
+     */
+    template<typename T>
+    void CompInfoStore<T>::CompBackupInfo::update_info(const CompInfo<T> &comp_info)
+    {
+      assert(comp_name_ == comp_info.get_comp_name());
+      assert(comp_phase_name_ == comp_info.get_comp_phase_name());
+      std::pair<int, int> pet_range = comp_info.get_pet_range();
+      int npets = pet_range.second - pet_range.first + 1;
+      typename std::vector<T>::iterator iter = std::find(past_npets_.begin(),
+        past_npets_.end(), static_cast<T>(npets));
+      if(iter == past_npets_.end()){
+        add_info(comp_info);
+        return;
+      }
 
+      std::size_t i = iter - past_npets_.begin();
+      std::pair<T, T> time_intvl = comp_info.get_time_interval();
+      T wtime = time_intvl.second - time_intvl.first;
+      T stime = comp_info.get_stime();
+      past_nsamples_[i]++;
+      past_wtimes_[i] += (wtime - past_wtimes_[i]) / past_nsamples_[i];
+      past_stimes_[i] += (stime - past_stimes_[i]) / past_nsamples_[i];
+      past_pet_ranges_[i] = pet_range;
+      past_time_intvls_[i] = std::pair<T, T>(time_intvl.first,
+                                              time_intvl.first + past_wtimes_[i]);
+
+      fit_scaling_function();
+    }
+
+    /* Fit the scaling function to the stored number of PETs and
+     * wallclock times
+     */
+    template<typename T>
+    void CompInfoStore<T>::CompBackupInfo::fit_scaling_function(void )
+    {
       /* The scaling function is a 2nd degree polynomial */
       const int MAX_DEG = 2;
       const int MIN_VALS_REQD_FOR_POLYFIT = 3;
@@ -4,6 +4,8 @@
 #include "ESMCI_VM.h"
 #include "ESMCI_MapperUtils.h"
 #include "mpi.h"
+#include <map>
+#include <stdint.h>
 
 namespace ESMCI{
 
@@ -61,6 +63,28 @@ namespace ESMCI{
       bool get_optimal(std::vector<int> &opt_npets,
                     std::vector<std::pair<int, int> > &opt_pet_ranges,
                     double &opt_wtime);
+      /* Online mode
+       *
+       * Collect the component (run) phase timings recorded by the ESMF
+       * profiler since the last collection, typically at the end of each
+       * coupling interval. The timings are aggregated, across all PETs,
+       * into one component info per component phase. This is a collective
+       * call and returns true if any timings were collected
+       */
+      bool collect_trace_info(void );
+      /* Online mode
+       *
+       * Refit the component scaling functions with the timings collected
+       * so far and optimize the PET layout, typically at checkpoint
+       * boundaries. If layout_fname is not empty the recommended layout
+       * is written to that file. This is a collective call
+       */
+      bool checkpoint(const std::string &layout_fname,
+                    std::vector<int> &opt_npets,
+                    std::vector<std::pair<int, int> > &opt_pet_ranges,
+                    double &opt_wtime);
+      /* Get the component infos used by the mapper */
+      std::vector<MapperUtil::CompInfo<double> > get_comp_info(void ) const;
       ~Mapper();
     private:
       ESMCI::VM &vm_;
@@ -76,12 +100,26 @@ namespace ESMCI{
       MapperUtil::LoadBalancer<double> lb_;
       std::string rseq_fname_;
       MapperUtil::RunSeqDGraph rseq_dgraph_;
+      /* Online mode: profiler counters (number of executions, total time)
+       * on this PET at the last collection, for each component phase
+       */
+      std::map<std::string, std::pair<std::size_t, uint64_t> > trace_counters_;
+      /* Online mode: mean wallclock time per collection, and the number of
+       * collections it is averaged over, for each component phase in
+       * comp_infos_
+       */
+      std::vector<std::pair<double, int> > online_wtimes_;
+      /* Online mode: number of component phases at the last checkpoint */
+      std::size_t online_ncomps_;
 
       void get_rseq_opt_layouts(
         std::vector<std::vector<MapperUtil::CompInfo<double> > > &opt_layouts);
       bool sync_opt_info(std::vector<int> &opt_npets,
                     std::vector<std::pair<int, int> > &opt_pet_ranges,
                     double &opt_wtime);
+      void write_layout(const std::string &layout_fname,
+                    const std::vector<std::pair<int, int> > &opt_pet_ranges,
+                    double opt_wtime) const;
   };
 
 } //namespace ESMCI
@@ -132,6 +170,21 @@ extern "C"{
         int comp_name_len, const char *comp_name,
         int phase_name_len, const char *phase_name,
         int *comp_pet_range_start, int *comp_pet_range_end);
+  /* Collect component phase timings from the ESMF profiler (online mode)
+   * mapper : The ESMF Mapper
+   */
+  int ESMCI_MapperCollectTraceInfo(ESMCI::Mapper *mapper);
+  /* Optimize the PET layout using the timings collected so far (online mode)
+   * mapper : The ESMF Mapper
+   * layout_fname_len : The length of the layout file name, 0 if the
+   *  recommended layout is not written to a file
+   * layout_fname : The name of the file to write the recommended layout to
+   * opt_threshold_reached : Is set to 1 if the Mapper has reached the
+   *  optimization threshold (The mapper cannot optimize further)
+   */
+  int ESMCI_MapperCheckpoint(ESMCI::Mapper *mapper,
+        int layout_fname_len, const char *layout_fname,
+        int *opt_threshold_reached);
   /* Destroy/Finalize the mapper */
   int ESMCI_MapperDestroy(ESMCI::Mapper *mapper);
 } // extern "C"
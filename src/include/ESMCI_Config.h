@@ -0,0 +1,28 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research, 
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics 
+// Laboratory, University of Michigan, National Centers for Environmental 
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory, 
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+//
+//-------------------------------------------------------------------------
+// (all lines below between the !BOP and !EOP markers will be included in 
+//  the automated document processing.)
+//-----------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef ESMCI_Config_H
+#define ESMCI_Config_H
+
+#include "ESMCI_F90Interface.h"
+
+// class declaration type -> this should be moved into ESMCI namespace
+class ESMCI_Config{
+  ESMCI::F90ClassHolder fortranclass;
+};
+
+#endif  // ESMCI_Config_H
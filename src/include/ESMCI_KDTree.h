@@ -0,0 +1,130 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+// ESMCI KDTree include file for C++
+
+// (all lines below between the !BOP and !EOP markers will be included in
+//  the automated document processing.)
+//-------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef ESMCI_KDTree_H
+#define ESMCI_KDTree_H
+
+// FOR ESMF
+#include <Mesh/include/Legacy/ESMCI_Exception.h>
+
+#include <vector>
+
+//-------------------------------------------------------------------------
+//BOP
+// !CLASS: ESMCI_KDTree - KDTree
+//
+// !DESCRIPTION:
+//
+// The code in this file defines the C++ {\tt KDTree} members and method
+// signatures (prototypes).  The companion file {\tt ESMCI\_KDTree.C}
+// contains the full code (bodies) for the {\tt KDTree} methods.
+//
+// A {\tt KDTree} is a static point index for nearest neighbor searches.
+// The usage mirrors {\tt OTree}: points are added, the tree is committed,
+// and then it may be queried. Nodes are stored flat in a single array and
+// point coordinates are stored by dimension in leaf order, so a query walks
+// contiguous memory instead of chasing pointers and calling back per point.
+//
+// Query results are reported as the position (0-based, in order of addition)
+// of the point. Ties in distance are broken by the smaller point id, which
+// gives the same answer as the OTree based searches.
+//
+///EOP
+//-------------------------------------------------------------------------
+
+
+// Start name space
+namespace ESMCI {
+
+  // Nodes which make up tree
+  class KDNode {
+  public:
+
+    // bounding box of the points in this node
+    double min[3],max[3];
+
+    // range [beg,end) of the points in this node in leaf order
+    int beg, end;
+
+    // index of children in node array, -1 for a leaf
+    int left, right;
+  };
+
+
+// class definition
+class KDTree {
+
+ private:
+
+  // Points as they were added
+  int max_size;
+  std::vector<double> add_coords;
+  std::vector<int> add_ids;
+
+  // Flat node array, root is 0
+  std::vector<KDNode> nodes;
+
+  // Point coordinates, ids and positions in leaf order
+  std::vector<double> x, y, z;
+  std::vector<int> ids;
+  std::vector<int> locs;
+
+  // committed
+  bool is_committed;
+
+  int build(int beg, int end, std::vector<int> &perm);
+
+  int leaf_of(const double pnt[3]) const;
+
+ public:
+
+  // KDTree Construct
+  KDTree(int max_size);
+
+  // KDTree Destruct
+  ~KDTree();
+
+  // Add a point to tree
+  void add(const double pnt[3], int id);
+
+  // Build tree
+  void commit();
+
+  // Number of points in tree
+  int size() const {return (int)add_ids.size();}
+
+  // Nearest point within sqrt(dist2) of pnt
+  int nearest(const double pnt[3], double &dist2) const;
+
+  // Nearest point to each of num points
+  void nearest(int num, const double *pnts, int *out_locs, double *out_dist2) const;
+
+  // Up to num_nbrs nearest points within sqrt(max_dist2) of pnt
+  int nearest_n(const double pnt[3], int num_nbrs, double max_dist2,
+                int *out_locs, double *out_dist2) const;
+
+  // Up to num_nbrs nearest points to each of num points
+  void nearest_n(int num, const double *pnts, int num_nbrs,
+                 int *out_num, int *out_locs, double *out_dist2) const;
+
+};  // end class KDTree
+
+
+} // END ESMCI namespace
+
+#endif  // ESMCI_KDTREE_H
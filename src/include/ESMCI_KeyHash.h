@@ -0,0 +1,32 @@
+/**
+ * Copyright 2017 HashMap Development Team
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef ESMCI_KEYHASH_H
+#define ESMCI_KEYHASH_H
+
+namespace ESMCI {
+  
+// Default hash function class
+template <typename K, size_t tableSize>
+struct KeyHash {
+    unsigned long operator()(const K &key) const
+    {
+        return reinterpret_cast<unsigned long>(key) % tableSize;
+    }
+};
+}
+
+#endif
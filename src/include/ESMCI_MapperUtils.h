@@ -0,0 +1,34 @@
+#ifndef ESMCI_MapperUtils_H
+#define ESMCI_MapperUtils_H
+// All the Mapper utils
+
+// Polynomial utils
+#include "ESMCI_Poly.h"
+#include "ESMCI_PolyUV.h"
+#include "ESMCI_PolyTwoV.h"
+#include "ESMCI_PolyDer.h"
+#include "ESMCI_PolyFit.h"
+
+// Matrix utils
+#include "ESMCI_Mat.h"
+
+// Graph utils
+#include "ESMCI_Graph.h"
+#include "ESMCI_GraphUtils.h"
+#include "ESMCI_GraphDotUtils.h"
+
+// Run sequence parser and graph utils
+#include "ESMCI_RunSeqDGraph.h"
+#include "ESMCI_RunSeqUtils.h"
+
+// Load balancer and solver
+#include "ESMCI_Solver.h"
+#include "ESMCI_LoadBalancer.h"
+
+// Component info and Execution block
+#include "ESMCI_CompInfo.h"
+#include "ESMCI_ExecBlock.h"
+#include "ESMCI_ExecBlockUtils.h"
+#include "ESMCI_ExecSim.h"
+
+#endif // ESMCI_MapperUtils_H